@@ -0,0 +1,67 @@
+#include <stm32f4_discovery.h>
+#include "bench.h"
+
+#define CYCLES (CPU_FREQUENCY / OS_FREQUENCY)
+
+bench_t  bench_result[BENCH_SIZE];
+unsigned bench_count = 0;
+
+static volatile int failed;
+
+void bench_fail(void)
+{
+	failed = 1;
+}
+
+int bench_failed(void)
+{
+	return failed;
+}
+
+void bench_call(const char *name, fun_t *fun, unsigned ops)
+{
+	bench_t *res;
+	cnt_t t;
+
+	failed = 0;
+	t = sys_time();
+	fun();
+	t = sys_time() - t;
+
+	if (bench_count >= BENCH_SIZE)
+		return;
+	res = &bench_result[bench_count++];
+	res->name   = name;
+	res->ops    = ops;
+	res->ticks  = (unsigned long) t;
+	res->status = failed ? benchFailed : t == 0 ? benchTooShort : benchDone;
+	if (res->status != benchDone)
+		return;
+	res->cycles = (unsigned long)((unsigned long long) t * CYCLES / ops);
+	res->rate   = (unsigned long)((unsigned long long) ops * OS_FREQUENCY / t);
+}
+
+int main()
+{
+	unsigned i;
+
+	LED_Init();
+
+	BENCH_AddUnit(bench_semaphore);
+	BENCH_AddUnit(bench_mutex);
+	BENCH_AddUnit(bench_message_queue);
+	BENCH_AddUnit(bench_mailbox_queue);
+	BENCH_AddUnit(bench_event_queue);
+	BENCH_AddUnit(bench_raw_buffer);
+	BENCH_AddUnit(bench_task);
+	BENCH_AddUnit(bench_alloc);
+	BENCH_AddUnit(bench_timer);
+	BENCH_AddUnit(bench_priority_queue);
+
+	for (i = 0; i < bench_count; i++)
+		if (bench_result[i].status == benchFailed)
+			LED[1] = 1;
+	LED[0] = 1;
+
+	tsk_stop();
+}
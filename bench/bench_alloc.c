@@ -0,0 +1,25 @@
+#include "bench.h"
+
+#define COUNT 100000
+
+static void bench()
+{
+	unsigned i;
+	sem_t *sem;
+
+	for (i = 0; i < COUNT; i++)
+	{
+		sem = sem_create(0, semBinary);
+		if (sem == NULL)
+		{
+			bench_fail();
+			break;
+		}
+		sem_delete(sem);
+	}
+}
+
+void bench_alloc()
+{
+	BENCH_Call("sem create/delete", COUNT);
+}
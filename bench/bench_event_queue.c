@@ -0,0 +1,46 @@
+#include "bench.h"
+
+#define COUNT 100000
+
+static_EVQ(evq1, 1);
+static_EVQ(evq2, 1);
+static_TSK(tsk1, 1, NULL);
+
+static void fail()
+{
+	bench_fail();
+	evq_reset(evq1);
+	evq_reset(evq2);
+}
+
+static void proc()
+{
+	unsigned i;
+	unsigned value;
+
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (evq_wait(evq1, &value) != E_SUCCESS || evq_give(evq2, value) != E_SUCCESS)
+			fail();
+	}
+	tsk_stop();
+}
+
+static void bench()
+{
+	unsigned i;
+	unsigned value;
+
+	tsk_startFrom(tsk1, proc);
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (evq_give(evq1, i) != E_SUCCESS || evq_wait(evq2, &value) != E_SUCCESS || value != i)
+			fail();
+	}
+	tsk_join(tsk1);
+}
+
+void bench_event_queue()
+{
+	BENCH_Call("evq round trip", COUNT);
+}
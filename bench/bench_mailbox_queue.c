@@ -0,0 +1,46 @@
+#include "bench.h"
+
+#define COUNT 100000
+
+static_BOX(box1, 1, sizeof(unsigned));
+static_BOX(box2, 1, sizeof(unsigned));
+static_TSK(tsk1, 1, NULL);
+
+static void fail()
+{
+	bench_fail();
+	box_reset(box1);
+	box_reset(box2);
+}
+
+static void proc()
+{
+	unsigned i;
+	unsigned value;
+
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (box_wait(box1, &value) != E_SUCCESS || box_give(box2, &value) != E_SUCCESS)
+			fail();
+	}
+	tsk_stop();
+}
+
+static void bench()
+{
+	unsigned i;
+	unsigned value;
+
+	tsk_startFrom(tsk1, proc);
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (box_give(box1, &i) != E_SUCCESS || box_wait(box2, &value) != E_SUCCESS || value != i)
+			fail();
+	}
+	tsk_join(tsk1);
+}
+
+void bench_mailbox_queue()
+{
+	BENCH_Call("box round trip", COUNT);
+}
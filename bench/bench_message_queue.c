@@ -0,0 +1,50 @@
+#include "bench.h"
+
+#define COUNT 100000
+#define LIMIT 16
+#define SIZE  sizeof(unsigned)
+
+static_MSG(msg1, LIMIT, SIZE);
+static_TSK(tsk1, 1, NULL);
+
+static void fail()
+{
+	bench_fail();
+	msg_reset(msg1);
+}
+
+static void proc()
+{
+	unsigned i;
+
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (msg_send(msg1, &i, SIZE) != E_SUCCESS)
+			fail();
+	}
+	tsk_stop();
+}
+
+// producer and consumer run with the same priority, so the queue is filled and drained in bursts
+
+static void bench()
+{
+	unsigned i;
+	unsigned value;
+	unsigned read;
+
+	tsk_prio(1);
+	tsk_startFrom(tsk1, proc);
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (msg_wait(msg1, &value, SIZE, &read) != E_SUCCESS || read != SIZE)
+			fail();
+	}
+	tsk_join(tsk1);
+	tsk_prio(OS_MAIN_PRIO);
+}
+
+void bench_message_queue()
+{
+	BENCH_Call("msg throughput", COUNT);
+}
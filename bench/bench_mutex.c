@@ -0,0 +1,51 @@
+#include "bench.h"
+
+#define COUNT 100000
+
+static_MTX(mtx1, mtxDefault);
+static_TSK(tsk1, 1, NULL);
+
+static void fail()
+{
+	bench_fail();
+	mtx_reset(mtx1);
+}
+
+static void proc()
+{
+	unsigned i;
+
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (mtx_wait(mtx1) != E_SUCCESS || mtx_give(mtx1) != E_SUCCESS)
+			fail();
+	}
+	tsk_stop();
+}
+
+// both tasks have the same priority, so the mutex is handed over to the waiting task on every give
+
+static void bench()
+{
+	unsigned i;
+
+	tsk_prio(1);
+	if (mtx_wait(mtx1) != E_SUCCESS)
+		fail();
+	tsk_startFrom(tsk1, proc);
+	tsk_yield();
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (mtx_give(mtx1) != E_SUCCESS || mtx_wait(mtx1) != E_SUCCESS)
+			fail();
+	}
+	if (!bench_failed() && mtx_give(mtx1) != E_SUCCESS)
+		fail();
+	tsk_join(tsk1);
+	tsk_prio(OS_MAIN_PRIO);
+}
+
+void bench_mutex()
+{
+	BENCH_Call("mtx handoff", COUNT);
+}
@@ -0,0 +1,44 @@
+#include "bench.h"
+#include "PriorityMessageQueue.h"
+
+#define COUNT 10000
+#define LIMIT    64
+
+// give/wait pairs at the lowest priority, so every wait scans all the levels;
+// the queue already holds 'depth' messages, the cost should grow with the num of levels only
+// (filling and draining the queue is part of the run, at most 0.3% of the operations)
+
+template<unsigned levels>
+PriorityMessageQueueT<LIMIT, sizeof(unsigned), levels> pmq;
+
+template<unsigned levels, unsigned depth>
+static void bench()
+{
+	unsigned i;
+	unsigned value;
+
+	for (i = 0; i < depth && !bench_failed(); i++)
+	{
+		if (pmq<levels>.give(0, &i) != E_SUCCESS)
+			bench_fail();
+	}
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (pmq<levels>.give(0, &i) != E_SUCCESS || pmq<levels>.wait(&value) != E_SUCCESS)
+			bench_fail();
+	}
+	for (i = 0; i < depth && !bench_failed(); i++)
+	{
+		if (pmq<levels>.wait(&value) != E_SUCCESS)
+			bench_fail();
+	}
+}
+
+extern "C"
+void bench_priority_queue()
+{
+	bench_call("pmq  4 levels, depth  0", bench< 4,  0>, COUNT);
+	bench_call("pmq  4 levels, depth 32", bench< 4, 32>, COUNT);
+	bench_call("pmq 16 levels, depth  0", bench<16,  0>, COUNT);
+	bench_call("pmq 16 levels, depth 32", bench<16, 32>, COUNT);
+}
@@ -0,0 +1,49 @@
+#include "bench.h"
+
+#define COUNT 100000
+#define SIZE  sizeof(unsigned)
+
+static_RAW(raw1, SIZE);
+static_RAW(raw2, SIZE);
+static_TSK(tsk1, 1, NULL);
+
+static void fail()
+{
+	bench_fail();
+	raw_reset(raw1);
+	raw_reset(raw2);
+}
+
+static void proc()
+{
+	unsigned i;
+	unsigned value;
+	unsigned read;
+
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (raw_wait(raw1, &value, SIZE, &read) != E_SUCCESS || raw_give(raw2, &value, read) != E_SUCCESS)
+			fail();
+	}
+	tsk_stop();
+}
+
+static void bench()
+{
+	unsigned i;
+	unsigned value;
+	unsigned read;
+
+	tsk_startFrom(tsk1, proc);
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (raw_give(raw1, &i, SIZE) != E_SUCCESS || raw_wait(raw2, &value, SIZE, &read) != E_SUCCESS || value != i)
+			fail();
+	}
+	tsk_join(tsk1);
+}
+
+void bench_raw_buffer()
+{
+	BENCH_Call("raw round trip", COUNT);
+}
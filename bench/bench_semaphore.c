@@ -0,0 +1,44 @@
+#include "bench.h"
+
+#define COUNT 100000
+
+static_SEM(sem1, 0, semBinary);
+static_SEM(sem2, 0, semBinary);
+static_TSK(tsk1, 1, NULL);
+
+static void fail()
+{
+	bench_fail();
+	sem_reset(sem1);
+	sem_reset(sem2);
+}
+
+static void proc()
+{
+	unsigned i;
+
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (sem_wait(sem1) != E_SUCCESS || sem_give(sem2) != E_SUCCESS)
+			fail();
+	}
+	tsk_stop();
+}
+
+static void bench()
+{
+	unsigned i;
+
+	tsk_startFrom(tsk1, proc);
+	for (i = 0; i < COUNT && !bench_failed(); i++)
+	{
+		if (sem_give(sem1) != E_SUCCESS || sem_wait(sem2) != E_SUCCESS)
+			fail();
+	}
+	tsk_join(tsk1);
+}
+
+void bench_semaphore()
+{
+	BENCH_Call("sem ping-pong", COUNT);
+}
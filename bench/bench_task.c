@@ -0,0 +1,29 @@
+#include "bench.h"
+
+#define COUNT 10000
+
+static void proc()
+{
+	tsk_stop();
+}
+
+static void bench()
+{
+	unsigned i;
+	tsk_t *tsk;
+
+	for (i = 0; i < COUNT; i++)
+	{
+		tsk = tsk_create(1, proc);
+		if (tsk == NULL || tsk_join(tsk) != E_SUCCESS)
+		{
+			bench_fail();
+			break;
+		}
+	}
+}
+
+void bench_task()
+{
+	BENCH_Call("tsk create/join", COUNT);
+}
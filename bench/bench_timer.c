@@ -0,0 +1,46 @@
+#include "bench.h"
+
+#define COUNT  100000
+#define TIMERS   1000
+
+static tmr_t tmr0;
+static tmr_t tmr[TIMERS];
+
+static void bench()
+{
+	unsigned i;
+
+	for (i = 0; i < COUNT; i++)
+	{
+		tmr_start(&tmr0, SEC, 0);
+		tmr_stop(&tmr0);
+	}
+}
+
+// the timers are started with long, scattered delays, so every start and stop works on the sorted list
+// of up to TIMERS live timers; none of them expires during the run
+
+static void bench_live()
+{
+	unsigned i, j;
+
+	for (i = 0; i < COUNT / TIMERS; i++)
+	{
+		for (j = 0; j < TIMERS; j++)
+			tmr_start(&tmr[j], SEC + (cnt_t)(j * 37 % TIMERS), 0);
+		for (j = 0; j < TIMERS; j++)
+			tmr_stop(&tmr[j]);
+	}
+}
+
+void bench_timer()
+{
+	unsigned i;
+
+	tmr_init(&tmr0, NULL);
+	for (i = 0; i < TIMERS; i++)
+		tmr_init(&tmr[i], NULL);
+
+	BENCH_Call("tmr start/stop", COUNT);
+	bench_call("tmr start/stop with 1000 live timers", bench_live, COUNT);
+}
@@ -0,0 +1,47 @@
+#include <os.h>
+
+#pragma once
+
+#define BENCH_SIZE             32 // max num of results
+
+// results are kept in bench_result[] and have to be read with the debugger (e.g. 'print bench_result' in gdb),
+// the board has no console; LED[0] lights up when all the benchmarks have finished, LED[1] when any of them failed
+
+enum
+{
+	benchDone,
+	benchFailed,
+	benchTooShort, // the run was below the resolution of the system timer
+};
+
+typedef struct
+{
+	const char   *name;
+	unsigned      ops;    // num of operations
+	unsigned long ticks;  // duration of the run
+	unsigned long cycles; // cycles per operation
+	unsigned long rate;   // operations per second
+	int           status;
+}	bench_t;
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+extern bench_t  bench_result[BENCH_SIZE];
+extern unsigned bench_count;
+
+void bench_call(const char *name, fun_t *fun, unsigned ops);
+
+// a task that gets an unexpected result marks the run as failed with bench_fail and resets the objects it shares
+// with its partner; the reset wakes the partner blocked on them with E_STOPPED, both loops check bench_failed,
+// so an error ends the run and is reported instead of leaving the other task blocked forever
+void bench_fail(void);
+int  bench_failed(void);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#define BENCH_AddUnit(unit)    do { void unit(void); unit();           } while (0)
+#define BENCH_Call(name, ops)  do { bench_call(name, bench, ops);      } while (0)
@@ -0,0 +1,59 @@
+#include <stm32f4_discovery.h>
+#include <os.h>
+#include "PriorityMessageQueue.h"
+
+using namespace device;
+using namespace stateos;
+
+enum { Telemetry, Control = 3 };
+
+auto led = Led();
+auto msg = PriorityMessageQueueT<8, sizeof(unsigned)>();
+
+void consumer()
+{
+	unsigned x;
+
+	for (;;)
+	{
+		thisTask::delay(SEC / 4);
+		msg.wait(&x);
+		led = x;
+	}
+}
+
+void telemetry()
+{
+	unsigned x = 0;
+
+	for (;;)
+	{
+		thisTask::delay(SEC / 8);
+		msg.give(Telemetry, &x);
+	}
+}
+
+void control()
+{
+	unsigned x = 1;
+
+	for (;;)
+	{
+		thisTask::delay(SEC);
+		msg.give(Control, &x);
+		x = (x << 1) | (x >> 3);
+	}
+}
+
+auto cons = Task(0, consumer);
+auto tele = Task(0, telemetry);
+auto ctrl = Task(0, control);
+
+int main()
+{
+	cons.start();
+	tele.start();
+	ctrl.start();
+
+	thisTask::stop();
+}
@@ -0,0 +1,156 @@
+#include <stm32f4_discovery.h>
+#include <os.h>
+#include <array>
+#include <cstdint>
+
+// Compile-time dispatch table for a hierarchical state machine:
+// the action table is compiled into a constexpr state x event jump table; every cell holds the number of states to exit
+// and the least common ancestor of the source and the target, so the exit and entry paths are walked along parent[]
+// and a cell takes eight bytes regardless of the depth of the hierarchy; the table can live in flash
+
+enum State : uint8_t
+{
+	StateRoot,
+	StateOff,
+	StateOn,
+	States,
+	StateNone = States,
+};
+
+enum Event : unsigned
+{
+	EventSwitch,
+	EventTick,
+	Events,
+};
+
+using Handler = void (*)( unsigned );
+
+struct Action
+{
+	State   state;
+	Event   event;
+	State   target;
+	Handler handler;
+};
+
+struct Transition
+{
+	Handler handler { nullptr };
+	State   target  { StateNone };
+	State   lca     { StateNone };
+	uint8_t exits   { 0 };
+	bool    valid   { false };
+};
+
+auto led = device::Led();
+auto evq = stateos::EventQueueT<8>();
+
+constexpr State parent[States] = { StateNone, StateRoot, StateRoot };
+
+constexpr Action tab[] =
+{
+	{ StateOff,  EventSwitch, StateOn,   nullptr },
+	{ StateOn,   EventSwitch, StateOff,  nullptr },
+	{ StateOn,   EventTick,   StateNone, []( unsigned ){ led.tick(); } },
+	{ StateRoot, EventTick,   StateNone, nullptr }, // ignored in all other states
+};
+
+void (* const onEntry[States])() = { nullptr, []{ led = 0; }, nullptr };
+void (* const onExit [States])() = { nullptr, nullptr,         nullptr };
+
+constexpr int depth( State s )
+{
+	int d = -1;
+	for (; s != StateNone; s = parent[s]) d++;
+	return d;
+}
+
+constexpr Transition make( State source, const Action &action )
+{
+	Transition t {};
+	t.handler = action.handler;
+	t.target  = action.target;
+	t.valid   = true;
+	if (action.target == StateNone)
+		return t; // internal transition
+
+	State src = source;
+	State dst = action.target;
+	if (src == dst)
+	{	// external self-transition
+		t.exits++;
+		src = parent[src];
+	}
+	while (depth(src) > depth(dst)) { t.exits++; src = parent[src]; }
+	while (depth(dst) > depth(src)) { dst = parent[dst]; }
+	while (src != dst) { t.exits++; src = parent[src]; dst = parent[dst]; }
+	t.lca = src;
+	return t;
+}
+
+constexpr auto compile()
+{
+	std::array<std::array<Transition, Events>, States> jump {};
+	for (unsigned s = 0; s < States; s++)
+		for (unsigned e = 0; e < Events; e++)
+			for (State p = State(s); p != StateNone && !jump[s][e].valid; p = parent[p])
+				for (const Action &action : tab)
+					if (action.state == p && action.event == e)
+						{ jump[s][e] = make(State(s), action); break; }
+	return jump;
+}
+
+constexpr auto jump = compile();
+
+State state = StateOff;
+
+void enter( State s, State lca )
+{
+	if (s == lca)
+		return;
+	enter(parent[s], lca); // outermost state first
+	if (onEntry[s]) onEntry[s]();
+}
+
+void dispatch( unsigned event )
+{
+	const Transition &t = jump[state][event];
+	if (!t.valid)
+		return;
+	State s = state;
+	for (unsigned i = 0; i < t.exits; i++, s = parent[s])
+		if (onExit[s]) onExit[s]();
+	if (t.handler)
+		t.handler(event);
+	if (t.target != StateNone)
+	{
+		enter(t.target, t.lca);
+		state = t.target;
+	}
+}
+
+void dispatcher()
+{
+	unsigned event;
+
+	for (;;)
+	{
+		evq.wait(&event);
+		dispatch(event);
+	}
+}
+
+auto disp = stateos::Task(0, dispatcher);
+
+int main()
+{
+	onEntry[state]();
+	disp.start();
+	evq.give(EventSwitch);
+	for (;;)
+	{
+		stateos::thisTask::delay(SEC);
+		evq.give(EventTick);
+	}
+}
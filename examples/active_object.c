@@ -0,0 +1,218 @@
+#include <stm32f4_discovery.h>
+#include <os.h>
+
+// Active objects: many small state machines share a single dispatcher task;
+// every machine has its own event queue, the dispatcher always serves the machine with the highest priority,
+// machines with the same priority are served in turn and each event is run to completion before the next one is taken;
+// machines with pending events wait in a fifo of their priority level, non-empty fifos are found with a two-level bitmap
+
+#define AO_PRIOS 64 // num of priority levels (a multiple of 32, up to 1024)
+#define AO_SIZE   4 // size of the event queue of an active object
+
+#if AO_PRIOS % 32 != 0 || AO_PRIOS > 1024
+#error invalid num of priority levels
+#endif
+
+typedef struct ao ao_t;
+typedef void ao_fun_t( ao_t *ao, unsigned event );
+
+struct ao
+{
+	ao_fun_t *state;
+	ao_t     *next;
+	unsigned  prio;
+	unsigned  head;
+	unsigned  count;
+	unsigned  queue[AO_SIZE];
+	unsigned  id;
+};
+
+typedef struct
+{
+	ao_t *head;
+	ao_t *tail;
+}	ao_fifo_t;
+
+enum
+{
+	EventInit,
+	EventTick,
+	EventSwitch,
+};
+
+OS_SEM(ao_sem, 0, semCounting);
+
+ao_fifo_t ao_fifo[AO_PRIOS];       // machines with pending events, per priority level
+uint32_t  ao_ready[AO_PRIOS / 32]; // non-empty fifos
+uint32_t  ao_group;                // non-zero words of ao_ready
+
+static unsigned ao_msb(uint32_t x)
+{
+	unsigned n = 0;
+
+	while (x >>= 1) n++;
+	return n;
+}
+
+// both functions are called under the system lock
+
+static void ao_link(ao_t *ao)
+{
+	ao_fifo_t *fifo = &ao_fifo[ao->prio];
+
+	ao->next = NULL;
+	if (fifo->head == NULL)
+	{
+		fifo->head = ao;
+		ao_ready[ao->prio / 32] |= 1UL << (ao->prio % 32);
+		ao_group |= 1UL << (ao->prio / 32);
+	}
+	else
+	{
+		fifo->tail->next = ao;
+	}
+	fifo->tail = ao;
+}
+
+static ao_t *ao_unlink(void)
+{
+	ao_fifo_t *fifo;
+	ao_t *ao;
+	unsigned grp, prio;
+
+	if (ao_group == 0)
+		return NULL;
+
+	grp  = ao_msb(ao_group);
+	prio = grp * 32 + ao_msb(ao_ready[grp]);
+	fifo = &ao_fifo[prio];
+	ao   = fifo->head;
+	fifo->head = ao->next;
+	if (fifo->head == NULL)
+	{
+		ao_ready[grp] &= ~(1UL << (prio % 32));
+		if (ao_ready[grp] == 0)
+			ao_group &= ~(1UL << grp);
+	}
+	return ao;
+}
+
+int ao_start(ao_t *ao, unsigned prio, ao_fun_t *state)
+{
+	if (prio >= AO_PRIOS)
+		return E_FAILURE;
+
+	ao->state = state;
+	ao->prio  = prio;
+	ao->head  = 0;
+	ao->count = 0;
+	return E_SUCCESS;
+}
+
+int ao_post(ao_t *ao, unsigned event)
+{
+	int result = E_FAILURE;
+
+	sys_lock();
+	{
+		if (ao->count < AO_SIZE)
+		{
+			ao->queue[(ao->head + ao->count) % AO_SIZE] = event;
+			if (ao->count++ == 0)
+				ao_link(ao);
+			result = E_SUCCESS;
+		}
+	}
+	sys_unlock();
+
+	if (result == E_SUCCESS)
+		sem_give(ao_sem);
+
+	return result;
+}
+
+void dispatcher()
+{
+	ao_t *ao;
+	unsigned event;
+
+	for (;;)
+	{
+		sem_wait(ao_sem);
+
+		event = 0;
+		sys_lock();
+		{
+			ao = ao_unlink();
+			if (ao != NULL)
+			{
+				event = ao->queue[ao->head];
+				ao->head = (ao->head + 1) % AO_SIZE;
+				if (--ao->count > 0)
+					ao_link(ao); // back to the end of the fifo of its priority level
+			}
+		}
+		sys_unlock();
+
+		if (ao != NULL)
+			ao->state(ao, event);
+	}
+}
+
+OS_TSK(disp, 1, dispatcher);
+
+void StateOff(ao_t *ao, unsigned event);
+void StateOn (ao_t *ao, unsigned event);
+
+void StateOff(ao_t *ao, unsigned event)
+{
+	switch (event)
+	{
+	case EventInit:
+		LED[ao->id] = 0;
+		break;
+	case EventSwitch:
+		ao->state = StateOn;
+		break;
+	}
+}
+
+void StateOn(ao_t *ao, unsigned event)
+{
+	switch (event)
+	{
+	case EventTick:
+		LED[ao->id]++;
+		break;
+	case EventSwitch:
+		LED[ao->id] = 0;
+		ao->state = StateOff;
+		break;
+	}
+}
+
+ao_t blinker[4];
+
+int main()
+{
+	unsigned i, n = 0;
+
+	LED_Init();
+
+	for (i = 0; i < 4; i++)
+	{
+		blinker[i].id = i;
+		ao_start(&blinker[i], i / 2, StateOff);
+		ao_post(&blinker[i], EventInit);
+	}
+
+	tsk_start(disp);
+
+	for (;;)
+	{
+		tsk_delay(SEC / 4);
+		for (i = 0; i < 4; i++)
+			ao_post(&blinker[i], EventTick);
+		ao_post(&blinker[n++ % 4], EventSwitch);
+	}
+}
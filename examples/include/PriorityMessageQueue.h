@@ -0,0 +1,45 @@
+#include <os.h>
+#include <array>
+
+#pragma once
+
+// Priority message queue: one mailbox queue per priority level and a counting semaphore of all stored messages;
+// wait always returns the oldest of the messages with the highest priority
+
+template<unsigned limit_, size_t size_, unsigned levels_ = 4>
+struct PriorityMessageQueueT
+{
+	int give( const unsigned _prio, const void *_data )
+	{
+		if (_prio >= levels_)
+			return E_FAILURE;
+
+		int result = box_[_prio].give(_data);
+		if (result == E_SUCCESS)
+			cnt_.give();
+		return result;
+	}
+
+	int wait( void *_data, unsigned *_prio = nullptr )
+	{
+		int result = cnt_.wait();
+		if (result != E_SUCCESS)
+			return result;
+
+		stateos::CriticalSection cs;
+		for (unsigned prio = levels_; prio-- > 0; )
+		{
+			if (box_[prio].take(_data) == E_SUCCESS)
+			{
+				if (_prio != nullptr)
+					*_prio = prio;
+				return E_SUCCESS;
+			}
+		}
+		return E_FAILURE; // system shouldn't get here
+	}
+
+	private:
+	std::array<stateos::MailBoxQueueT<limit_, size_>, levels_> box_;
+	stateos::Semaphore cnt_ { 0 };
+};
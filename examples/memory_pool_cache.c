@@ -0,0 +1,135 @@
+#include <stm32f4_discovery.h>
+#include <os.h>
+#include <string.h>
+
+// Per-task magazine caches for a shared memory pool:
+// every task allocates from and frees to its own magazine without entering the critical section,
+// the magazine is refilled from and drained to the pool in batches under a single critical section;
+// the producer sends bursts of BURST blocks, the consumer returns its cached blocks to the pool whenever it runs idle;
+// LED[0] toggles with every burst, LED[1] and LED[2] with every refill of the producer's and drain of the consumer's
+// magazine, LED[3] lights up when the consumer had blocks cached before the flush
+
+#define BLOCKS 32 // num of blocks in the pool
+#define SIZE    8 // num of blocks held by a magazine
+#define BATCH   4 // num of blocks moved between a magazine and the pool at once
+#define BURST  10 // num of blocks sent by the producer at once
+
+typedef struct
+{
+	mem_t   *pool;
+	unsigned count;  // occupancy of the magazine
+	unsigned refill; // num of batches taken from the pool
+	unsigned drain;  // num of batches returned to the pool
+	void    *block[SIZE];
+}	mag_t;
+
+OS_MEM(mem, BLOCKS, sizeof(unsigned));
+OS_LST(lst);
+
+mag_t cons_mag;
+mag_t prod_mag;
+
+void mag_init(mag_t *mag, mem_t *pool)
+{
+	memset(mag, 0, sizeof(mag_t));
+	mag->pool = pool;
+}
+
+void *mag_alloc(mag_t *mag)
+{
+	void *p;
+
+	if (mag->count == 0)
+	{
+		sys_lock();
+		{
+			while (mag->count < BATCH && mem_take(mag->pool, &p) == E_SUCCESS)
+				mag->block[mag->count++] = p;
+		}
+		sys_unlock();
+		if (mag->count == 0)
+		{
+			mem_wait(mag->pool, &p);
+			return p;
+		}
+		mag->refill++;
+	}
+
+	return mag->block[--mag->count];
+}
+
+void mag_free(mag_t *mag, void *p)
+{
+	if (mag->count == SIZE)
+	{
+		sys_lock();
+		{
+			while (mag->count > SIZE - BATCH)
+				mem_give(mag->pool, mag->block[--mag->count]);
+		}
+		sys_unlock();
+		mag->drain++;
+	}
+
+	mag->block[mag->count++] = p;
+}
+
+void mag_flush(mag_t *mag)
+{
+	sys_lock();
+	{
+		while (mag->count > 0)
+			mem_give(mag->pool, mag->block[--mag->count]);
+	}
+	sys_unlock();
+}
+
+void consumer()
+{
+	void *p;
+
+	for (;;)
+	{
+		if (lst_take(lst, &p) != E_SUCCESS)
+		{
+			LED[1] = prod_mag.refill & 1;
+			LED[2] = cons_mag.drain & 1;
+			LED[3] = cons_mag.count > 0;
+			mag_flush(&cons_mag);
+			lst_wait(lst, &p);
+		}
+		if (*(unsigned *)p == 0)
+			LED[0]++;
+		mag_free(&cons_mag, p);
+	}
+}
+
+void producer()
+{
+	void *p;
+
+	for (;;)
+	{
+		tsk_delay(SEC);
+		for (unsigned i = 0; i < BURST; i++)
+		{
+			p = mag_alloc(&prod_mag);
+			*(unsigned *)p = i;
+			lst_give(lst, p);
+		}
+	}
+}
+
+OS_TSK(cons, 0, consumer);
+OS_TSK(prod, 0, producer);
+
+int main()
+{
+	LED_Init();
+
+	mag_init(&cons_mag, mem);
+	mag_init(&prod_mag, mem);
+	tsk_start(cons);
+	tsk_start(prod);
+	tsk_stop();
+}
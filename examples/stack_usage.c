@@ -0,0 +1,76 @@
+#include <stm32f4_discovery.h>
+#include <os.h>
+#include <string.h>
+
+// Stack high-water mark: stacks are painted once before the first start of the task,
+// the peak usage is found by searching for the first overwritten byte from the bottom of the stack;
+// LED[0] blinks with the consumer, LED[1 + i] lights up when task i has used more than LIMIT percent of its stack
+
+#define PAINT 0xA5
+#define LIMIT   50
+
+typedef struct
+{
+	stk_t *stk;
+	size_t size;
+}	stk_info_t;
+
+sem_t sem;
+tsk_t cons; stk_t cons_stk[STK_SIZE(256)];
+tsk_t prod; stk_t prod_stk[STK_SIZE(512)];
+
+stk_info_t report[] =
+{
+	{ cons_stk, sizeof(cons_stk) },
+	{ prod_stk, sizeof(prod_stk) },
+};
+#define reportsize (int)(sizeof(report)/sizeof(report[0]))
+
+void stk_paint(stk_t *stk, size_t size)
+{
+	memset(stk, PAINT, size);
+}
+
+size_t stk_free(const stk_t *stk, size_t size)
+{
+	const unsigned char *ptr = (const unsigned char *) stk;
+	size_t len = 0;
+
+	while (len < size && ptr[len] == PAINT) len++;
+	return len;
+}
+
+size_t stk_used(const stk_t *stk, size_t size)
+{
+	return size - stk_free(stk, size);
+}
+
+void stk_report()
+{
+	for (int i = 0; i < reportsize; i++)
+		LED[1 + i] = stk_used(report[i].stk, report[i].size) * 100 > report[i].size * LIMIT;
+}
+
+void consumer()
+{
+	sem_wait(&sem);
+	LED[0]++;
+}
+
+void producer()
+{
+	tsk_delay(SEC);
+	sem_give(&sem);
+	stk_report();
+}
+
+int main()
+{
+	LED_Init();
+
+	sem_init(&sem, 0, semBinary);
+	for (int i = 0; i < reportsize; i++) stk_paint(report[i].stk, report[i].size);
+	tsk_init(&cons, 0, consumer, cons_stk, sizeof(cons_stk));
+	tsk_init(&prod, 0, producer, prod_stk, sizeof(prod_stk));
+	tsk_stop();
+}
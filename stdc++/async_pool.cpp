@@ -0,0 +1,220 @@
+#include "stm32f4_discovery.h"
+#include <os.h>
+#include <thread>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <numeric>
+#include <chrono>
+
+// std::async-like launching on a fixed pool of worker threads instead of a new thread per call:
+// every worker has its own job queue, idle workers steal jobs from the other queues,
+// a thread waiting for a result that nobody has started yet runs it itself, like a plain function call,
+// otherwise it runs other queued jobs in the meantime, so recursive jobs can't starve the pool;
+// a waiting thread only ever waits for a job already running on another thread, so it can block instead of spinning
+// and no thread has to be started when the helping gets too deep for the stack
+
+class ThreadPool
+{
+	// approximate stack taken by one helped job (get, steal, std::function, packaged_task and the job itself);
+	// half of the worker stack is left for the jobs
+	static constexpr unsigned frame_size  = 256;
+	static constexpr unsigned depth_limit = OS_STACK_SIZE / frame_size / 2;
+	static_assert(depth_limit > 0, "worker stack too small for helping");
+
+	struct Job
+	{
+		std::function<void()> fun;
+		std::atomic<bool>     taken { false };
+
+		bool claim() { return !taken.exchange(true); }
+	};
+
+	struct Queue
+	{
+		std::mutex                       mtx;
+		std::deque<std::shared_ptr<Job>> jobs;
+	};
+
+public:
+
+	template<class R>
+	struct Handle
+	{
+		std::future<R>       future;
+		std::shared_ptr<Job> job;
+	};
+
+	explicit ThreadPool( unsigned workers ): queues_(std::make_unique<Queue[]>(workers)), size_(workers)
+	{
+		for (unsigned i = 0; i < size_; i++)
+			workers_.emplace_back([this, i]{ run(i); });
+	}
+
+	~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mtx_);
+			done_ = true;
+		}
+		cv_.notify_all();
+		for (auto& worker : workers_)
+			worker.join();
+	}
+
+	template<class F, class... Args>
+	auto async( F&& f, Args&&... args )
+	{
+		using R = std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
+		auto task = std::make_shared<std::packaged_task<R()>>(std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+		auto job = std::make_shared<Job>();
+		job->fun = [task]{ (*task)(); };
+		Handle<R> handle { task->get_future(), job };
+		push(std::move(job));
+		return handle;
+	}
+
+	template<class R>
+	R get( Handle<R>& handle )
+	{
+		using namespace std::chrono_literals;
+		if (handle.job->claim())
+			handle.job->fun();
+		while (handle.future.wait_for(0s) != std::future_status::ready)
+		{
+			if (depth_ < depth_limit)
+			{
+				depth_++;
+				bool ran = steal(index_);
+				depth_--;
+				if (ran)
+					continue;
+			}
+			handle.future.wait();
+		}
+		return handle.future.get();
+	}
+
+private:
+
+	// pending_ is counted before the job is published, so a thief can't decrement it below zero
+	void push( std::shared_ptr<Job> job )
+	{
+		Queue& queue = queues_[index_ >= 0 ? unsigned(index_) : next_++ % size_];
+		{
+			std::lock_guard<std::mutex> lock(mtx_);
+			pending_++;
+		}
+		{
+			std::lock_guard<std::mutex> lock(queue.mtx);
+			queue.jobs.push_back(std::move(job));
+		}
+		cv_.notify_one();
+	}
+
+	// own queue is served from the back (lifo), the other queues are robbed from the front (fifo);
+	// jobs already claimed by the thread waiting for them are dropped
+	bool steal( int self )
+	{
+		std::shared_ptr<Job> job;
+		for (unsigned n = 0; n < size_ && !job; n++)
+		{
+			unsigned i = (self >= 0 ? unsigned(self) + n : n) % size_;
+			Queue& queue = queues_[i];
+			std::lock_guard<std::mutex> lock(queue.mtx);
+			while (!job && !queue.jobs.empty())
+			{
+				if (n == 0 && self >= 0)
+				{
+					job = std::move(queue.jobs.back());
+					queue.jobs.pop_back();
+				}
+				else
+				{
+					job = std::move(queue.jobs.front());
+					queue.jobs.pop_front();
+				}
+				pending_--;
+				if (!job->claim())
+					job.reset();
+			}
+		}
+		if (!job)
+			return false;
+		job->fun();
+		return true;
+	}
+
+	void run( unsigned self )
+	{
+		index_ = int(self);
+		for (;;)
+		{
+			if (steal(index_))
+				continue;
+			std::unique_lock<std::mutex> lock(mtx_);
+			cv_.wait(lock, [this]{ return done_ || pending_ > 0; });
+			if (done_ && pending_ == 0)
+				return;
+		}
+	}
+
+	std::unique_ptr<Queue[]>  queues_;
+	std::vector<std::thread>  workers_;
+	std::mutex                mtx_;
+	std::condition_variable   cv_;
+	std::atomic<unsigned>     pending_ { 0 };
+	std::atomic<unsigned>     next_    { 0 };
+	unsigned                  size_;
+	bool                      done_    { false };
+
+	static thread_local int      index_;
+	static thread_local unsigned depth_;
+};
+
+thread_local int      ThreadPool::index_ = -1;
+thread_local unsigned ThreadPool::depth_ =  0;
+
+// the workers are started on first use from main, not during static initialization
+
+ThreadPool& pool()
+{
+	static ThreadPool pool(4);
+	return pool;
+}
+
+template <typename It>
+int work(It beg, It end)
+{
+	auto len = end - beg;
+	if (len < 100)
+		return std::accumulate(beg, end, 0);
+	It mid = beg + len / 2;
+	auto handle = pool().async(work<It>, mid, end);
+	int sum = work(beg, mid);
+	return sum + pool().get(handle);
+}
+
+void test()
+{
+	std::vector<int> v(1000, 1);
+	int result = work(v.begin(), v.end());
+	if (result != 1000) abort();
+}
+
+int main()
+{
+	using namespace std::chrono_literals;
+	device::Led led;
+	for (;;)
+	{
+		test();
+		std::this_thread::sleep_for(100ms);
+		led.tick();
+	}
+}
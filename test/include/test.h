@@ -28,7 +28,7 @@ extern "C" {
 #endif
 
 void test_add (fun_t *fun);
-void test_call(fun_t *fun);
+cnt_t test_call(fun_t *fun);
 
 #ifdef  __cplusplus
 }
@@ -46,7 +46,9 @@ void test_call(fun_t *fun);
 #define UNIT_Notify()          do { puts(__func__); } while (0)
 #define TEST_Notify()          do { puts(__func__); } while (0)
 #endif//__CSMC__
+#define TEST_Report(t, ...)    do { printf(__VA_ARGS__); printf(": %u\n", (unsigned)(t)); } while (0)
 #else//!DEBUG
 #define UNIT_Notify()          do { LED_Tick(); } while (0)
 #define TEST_Notify()          do { LED_Tick(); } while (0)
+#define TEST_Report(t, ...)    do { (void)(t); } while (0)
 #endif//DEBUG
@@ -1,7 +1,7 @@
 #include "test.h"
 
 #define       LOOP 1
-#define       SIZE 68
+#define       SIZE 71
 
 static cnt_t  summary = 0;
 static fun_t *test[SIZE];
@@ -13,7 +13,7 @@ void test_add(fun_t *fun)
 	test[count++] = fun;
 }
 
-void test_call(fun_t *fun)
+cnt_t test_call(fun_t *fun)
 {
 	int i;
 	cnt_t t = sys_time();
@@ -23,6 +23,7 @@ void test_call(fun_t *fun)
 #ifdef DEBUG
 //	printf(": %u\n", (unsigned) t);
 #endif
+	return t;
 }
 
 static void test_init()
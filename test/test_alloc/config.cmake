@@ -6,5 +6,6 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_alloc_0.c
 	${CMAKE_CURRENT_LIST_DIR}/test_alloc_1.c
 	${CMAKE_CURRENT_LIST_DIR}/test_alloc_2.c
+	${CMAKE_CURRENT_LIST_DIR}/test_alloc_4.c
 	${CMAKE_CURRENT_LIST_DIR}/test_alloc_3.cpp
 )
@@ -6,6 +6,7 @@ void test_alloc()
 	TEST_Add(test_alloc_0);
 	TEST_Add(test_alloc_1);
 	TEST_Add(test_alloc_2);
+	TEST_Add(test_alloc_4);
 #ifndef __CSMC__
 	TEST_Add(test_alloc_3);
 #endif
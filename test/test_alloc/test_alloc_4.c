@@ -0,0 +1,48 @@
+#include "test.h"
+
+#define SIZE   512
+#define SLOTS   16
+#define ROUNDS  64
+
+static void *   buf[SLOTS];
+static unsigned failures;
+
+static void test()
+{
+	size_t len;
+	int i, n;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		n = rand() % SLOTS;
+		if (buf[n] != NULL)
+			free(buf[n]);
+		len = (size_t)rand() % (SIZE) + 1;
+		buf[n] = malloc(len);
+		if (buf[n] != NULL)
+			memset(buf[n], 0xFF, len);
+		else
+			failures++;
+	}
+}
+
+// the blocks live through all the passes, so the heap is fragmented by a long run of random sizes
+
+void test_alloc_4()
+{
+	size_t heap = sys_heapSize();
+	cnt_t t;
+	int n;
+
+	TEST_Notify();
+	failures = 0;
+	t = test_call(test);
+	for (n = 0; n < SLOTS; n++)
+	{
+		if (buf[n] != NULL)
+			free(buf[n]);
+		buf[n] = NULL;
+	}
+	ASSERT(heap==sys_heapSize());
+	TEST_Report(t, "%u of %u allocations failed", failures, PASS * ROUNDS);
+}
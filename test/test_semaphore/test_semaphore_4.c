@@ -0,0 +1,26 @@
+#include "test.h"
+
+#define COUNT 100
+
+static_SEM(sem3, 0, semBinary);
+
+static void test()
+{
+	int i;
+	int result;
+
+	for (i = 0; i < COUNT; i++)
+	{
+	result = sem_give(sem3);                      ASSERT_success(result);
+	result = sem_take(sem3);                      ASSERT_success(result);
+	}
+}
+
+// nobody waits for the semaphore, so the measured time is the cost of the uncontended path;
+// compare the results of builds with OS_ATOMICS set to 0 and 1
+
+void test_semaphore_4()
+{
+	TEST_Notify();
+	TEST_Report(test_call(test), "uncontended give/take (OS_ATOMICS %d)", OS_ATOMICS);
+}
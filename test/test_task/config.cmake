@@ -9,6 +9,7 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_task_create_3.c
 	${CMAKE_CURRENT_LIST_DIR}/test_task_infinite_loop_1.c
 	${CMAKE_CURRENT_LIST_DIR}/test_task_signal_1.c
+	${CMAKE_CURRENT_LIST_DIR}/test_task_switch_1.c
 	${CMAKE_CURRENT_LIST_DIR}/test_task_create_4.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_task_create_5.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_task_create_6.cpp
@@ -9,6 +9,7 @@ void test_task()
 	TEST_Add(test_task_create_3);
 	TEST_Add(test_task_infinite_loop_1);
 	TEST_Add(test_task_signal_1);
+	TEST_Add(test_task_switch_1);
 #ifndef __CSMC__
 	TEST_Add(test_task_infinite_loop_2);
 	TEST_Add(test_task_infinite_loop_3);
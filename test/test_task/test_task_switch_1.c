@@ -0,0 +1,69 @@
+#include "test.h"
+
+#define MAX_TASKS  64
+#define SWITCHES 4096
+
+static bar_t    bar;
+static tsk_t    tsk[MAX_TASKS];
+static stk_t    stk[MAX_TASKS][STK_SIZE(256)];
+static unsigned tasks;
+static unsigned started;
+static unsigned finished;
+static cnt_t    start;
+static cnt_t    elapsed;
+
+// only the yield phase is timed: from the first task leaving the barrier to the first task finishing its yields,
+// so the creation, the barrier and the teardown of the tasks do not depend on the number of ready tasks
+
+static void proc()
+{
+	unsigned i;
+	int result;
+
+	result = bar_wait(&bar);                      ASSERT_success(result);
+	sys_lock();
+	{
+		if (started++ == 0)
+			start = sys_time();
+	}
+	sys_unlock();
+	for (i = 0; i < SWITCHES / tasks; i++)
+	{
+	         tsk_yield();
+	}
+	sys_lock();
+	{
+		if (finished++ == 0)
+			elapsed += sys_time() - start;
+	}
+	sys_unlock();
+	         tsk_stop();
+}
+
+static void test()
+{
+	unsigned i;
+	int result;
+
+	         started = finished = 0;
+	         bar_init(&bar, tasks);
+	for (i = 0; i < tasks; i++)
+	         tsk_init(&tsk[i], 1, proc, stk[i], sizeof(stk[i]));
+	for (i = 0; i < tasks; i++)
+	{
+	result = tsk_join(&tsk[i]);                   ASSERT_success(result);
+	}
+}
+
+// the number of context switches per pass is constant for every group of ready tasks
+
+void test_task_switch_1()
+{
+	TEST_Notify();
+	for (tasks = 4; tasks <= MAX_TASKS; tasks *= 2)
+	{
+		elapsed = 0;
+		test_call(test);
+		TEST_Report(elapsed, "%3u ready tasks", tasks);
+	}
+}